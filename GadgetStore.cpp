@@ -31,14 +31,52 @@
 // sstream: Provides stringstream for formatting strings
 #include <sstream>
 
+// fstream: Provides file streams for saving and loading the inventory archive
+#include <fstream>
+
 // optional: Provides optional class for handling optional values
 #include <optional>
 
 // functional: Provides std::function for function objects
 #include <functional>
 
+// list: Provides doubly linked list for keeping cached searches in recency order
+#include <list>
+
+// unordered_map: Provides hash map for constant-time cache lookups
+#include <unordered_map>
+
+// memory: Provides shared_ptr for sharing cached search results without copies
+#include <memory>
+
+// cstdint: Provides fixed-width integer types for packed archive columns
+#include <cstdint>
+
+// cmath: Provides llround() for storing prices as whole cents
+#include <cmath>
+
+// cstring: Provides memcpy() for the binary gadget codec
+#include <cstring>
+
+// thread: Provides std::thread for parallel catalog scans
+#include <thread>
+
+// atomic: Provides atomic counter for handing out scan morsels to threads
+#include <atomic>
+
+// mutex, condition_variable: Provide synchronization for the scan worker pool
+#include <mutex>
+#include <condition_variable>
+
+// exception: Provides exception_ptr for passing worker errors back to the caller
+#include <exception>
+
+// system_error: Provides std::system_error for worker threads that fail to start
+#include <system_error>
+
 // Forward declarations
 class InputValidator;
+class GadgetSchema;
 
 /*
  * Gadget Class: Represents a single gadget item in the store
@@ -50,9 +88,12 @@ private:
     std::string category;       // Category (phone, laptop, etc.)
     std::string serialNumber;   // Unique identifier
     std::string brand;          // Manufacturer/brand name
-    double price;              // Price in currency
+    double price = 0.0;        // Price in currency
     std::string color;         // Color of the gadget
-    int stockQuantity;         // Available quantity in stock
+    int stockQuantity = 0;     // Available quantity in stock
+
+    // Field descriptors bind directly to the members above
+    friend class GadgetSchema;
 
 public:
     // Default constructor
@@ -66,12 +107,12 @@ public:
           brand(brand), price(price), color(color), stockQuantity(stockQuantity) {}
 
     // Getter methods: Return the respective property values
-    std::string getModel() const { return model; }
-    std::string getCategory() const { return category; }
-    std::string getSerialNumber() const { return serialNumber; }
-    std::string getBrand() const { return brand; }
+    const std::string& getModel() const { return model; }
+    const std::string& getCategory() const { return category; }
+    const std::string& getSerialNumber() const { return serialNumber; }
+    const std::string& getBrand() const { return brand; }
     double getPrice() const { return price; }
-    std::string getColor() const { return color; }
+    const std::string& getColor() const { return color; }
     int getStockQuantity() const { return stockQuantity; }
 
     // Setter methods: Update the respective property values
@@ -231,14 +272,14 @@ public:
                != lowerValidColors.end();
     }
 
-    // Get valid color input
-    static std::string getValidColorInput(const std::string& prompt) {
+    // Get valid color input (empty input keeps the current value unless allowEmpty is false)
+    static std::string getValidColorInput(const std::string& prompt, bool allowEmpty = true) {
         displayValidColors();
         std::string input;
         while (true) {
             std::cout << prompt;
-            std::getline(std::cin, input);
-            if (input.empty()) return input;
+            if (!std::getline(std::cin, input)) return "";
+            if (input.empty() && allowEmpty) return input;
             
             std::string lowerInput = input;
             std::transform(lowerInput.begin(), lowerInput.end(), lowerInput.begin(), ::tolower);
@@ -269,15 +310,16 @@ public:
         return isValidNumber(quantity, 0, MAX_QUANTITY);
     }
 
-    // Get valid input with retry mechanism
+    // Get valid input with retry mechanism (empty input is accepted unless allowEmpty is false)
     static std::string getValidInput(const std::string& prompt, 
                                    const std::function<bool(const std::string&)>& validator,
-                                   const std::string& errorMessage) {
+                                   const std::string& errorMessage,
+                                   bool allowEmpty = true) {
         std::string input;
         while (true) {
             std::cout << prompt;
-            std::getline(std::cin, input);
-            if (input.empty() || validator(input)) break;
+            if (!std::getline(std::cin, input)) return "";
+            if ((input.empty() && allowEmpty) || validator(input)) break;
             std::cout << errorMessage << "\n";
         }
         return input;
@@ -326,6 +368,1105 @@ public:
     }
 };
 
+/*
+ * GadgetSchema Class: Compile-time description of the Gadget fields
+ * Each field binds its member, table column, input prompt and InputValidator
+ * rule, and the accessors, validation, equality, ordering, hashing and binary
+ * codec for every field are generated from that list by the compiler
+ */
+class GadgetSchema {
+private:
+    // Rule for fields the store generates itself
+    template<typename T>
+    static bool anyValue(const T&) { return true; }
+
+    // Descriptor for a single field, resolved entirely at compile time
+    template<typename T, T Gadget::*Member, auto Validator>
+    struct Field {
+        using Type = T;
+
+        static const T& get(const Gadget& gadget) { return gadget.*Member; }
+        static void set(Gadget& gadget, const T& value) { gadget.*Member = value; }
+        static bool accepts(const T& value) { return Validator(value); }
+        static bool isValid(const Gadget& gadget) { return Validator(gadget.*Member); }
+        static bool equal(const Gadget& a, const Gadget& b) { return a.*Member == b.*Member; }
+        static size_t hash(const Gadget& gadget) { return std::hash<T>{}(gadget.*Member); }
+
+        // Three-way comparison: negative, zero or positive
+        static int compare(const Gadget& a, const Gadget& b) {
+            if (a.*Member < b.*Member) return -1;
+            return b.*Member < a.*Member ? 1 : 0;
+        }
+
+        // Strings are length-prefixed, numbers are copied as raw bytes
+        static void serialize(const Gadget& gadget, std::string& out) {
+            const T& value = gadget.*Member;
+            if constexpr (std::is_same_v<T, std::string>) {
+                uint32_t length = static_cast<uint32_t>(value.size());
+                out.append(reinterpret_cast<const char*>(&length), sizeof(length));
+                out.append(value);
+            } else {
+                out.append(reinterpret_cast<const char*>(&value), sizeof(T));
+            }
+        }
+
+        static bool deserialize(const std::string& in, size_t& pos, Gadget& gadget) {
+            T& value = gadget.*Member;
+            if (pos > in.size()) return false;
+            if constexpr (std::is_same_v<T, std::string>) {
+                uint32_t length;
+                if (in.size() - pos < sizeof(length)) return false;
+                std::memcpy(&length, in.data() + pos, sizeof(length));
+                pos += sizeof(length);
+                if (in.size() - pos < length) return false;
+                value.assign(in, pos, length);
+                pos += length;
+            } else {
+                if (in.size() - pos < sizeof(T)) return false;
+                std::memcpy(&value, in.data() + pos, sizeof(T));
+                pos += sizeof(T);
+            }
+            return true;
+        }
+    };
+
+    // Expands an operation over every field with fold expressions
+    template<typename... Fields>
+    struct FieldList {
+        template<typename Visitor>
+        static void forEach(Visitor&& visit) { (visit(Fields{}), ...); }
+
+        static bool isValid(const Gadget& gadget) { return (Fields::isValid(gadget) && ...); }
+
+        static bool equal(const Gadget& a, const Gadget& b) { return (Fields::equal(a, b) && ...); }
+
+        // Combines the field hashes in list order
+        static size_t hash(const Gadget& gadget) {
+            size_t seed = 0;
+            ((seed ^= Fields::hash(gadget) + 0x9e3779b9 + (seed << 6) + (seed >> 2)), ...);
+            return seed;
+        }
+
+        // Lexicographic over the fields, stopping at the first one that differs
+        static int compare(const Gadget& a, const Gadget& b) {
+            int result = 0;
+            (((result = Fields::compare(a, b)) == 0) && ...);
+            return result;
+        }
+
+        static void serialize(const Gadget& gadget, std::string& out) {
+            (Fields::serialize(gadget, out), ...);
+        }
+
+        static bool deserialize(const std::string& in, size_t& pos, Gadget& gadget) {
+            return (Fields::deserialize(in, pos, gadget) && ...);
+        }
+    };
+
+public:
+    // How a field is read from the console
+    enum class Input { Text, Color, Number };
+
+    // Field descriptors, in table column order
+    struct SerialNumber : Field<std::string, &Gadget::serialNumber, &anyValue<std::string>> {
+        static constexpr const char* header = "SERIAL#";
+        static constexpr int width = 8;
+    };
+
+    struct Brand : Field<std::string, &Gadget::brand, &InputValidator::isValidBrand> {
+        static constexpr const char* header = "BRAND";
+        static constexpr int width = 15;
+        static constexpr const char* name = "Brand";
+        static constexpr const char* prompt = "Enter brand name: ";
+        static constexpr Input input = Input::Text;
+        static std::string errorMessage() {
+            return ErrorMessages::brandLength(InputValidator::MAX_TEXT_LENGTH) + "\n" +
+                   ErrorMessages::brandFormat();
+        }
+    };
+
+    struct Model : Field<std::string, &Gadget::model, &InputValidator::isValidModel> {
+        static constexpr const char* header = "MODEL";
+        static constexpr int width = 15;
+        static constexpr const char* name = "Model";
+        static constexpr const char* prompt = "Enter gadget model: ";
+        static constexpr Input input = Input::Text;
+        static std::string errorMessage() {
+            return ErrorMessages::modelLength(InputValidator::MAX_TEXT_LENGTH) + "\n" +
+                   ErrorMessages::modelFormat();
+        }
+    };
+
+    struct Category : Field<std::string, &Gadget::category, &InputValidator::isValidCategory> {
+        static constexpr const char* header = "CATEGORY";
+        static constexpr int width = 10;
+        static constexpr const char* name = "Category";
+        static constexpr const char* prompt = "Enter gadget category: ";
+        static constexpr Input input = Input::Text;
+        static std::string errorMessage() {
+            return ErrorMessages::categoryFormat() + "\n" +
+                   ErrorMessages::categoryLength(InputValidator::MAX_TEXT_LENGTH);
+        }
+    };
+
+    struct Price : Field<double, &Gadget::price, &InputValidator::isValidPrice> {
+        static constexpr const char* header = "PRICE";
+        static constexpr int width = 8;
+        static constexpr const char* name = "Price";
+        static constexpr const char* prompt = "Enter price: ";
+        static constexpr Input input = Input::Number;
+        static constexpr double min = 0.0;
+        static constexpr double max = InputValidator::MAX_PRICE;
+    };
+
+    struct Color : Field<std::string, &Gadget::color, &InputValidator::isValidColor> {
+        static constexpr const char* header = "COLOR";
+        static constexpr int width = 10;
+        static constexpr const char* name = "Color";
+        static constexpr const char* prompt = "Enter color: ";
+        static constexpr Input input = Input::Color;
+    };
+
+    struct StockQuantity : Field<int, &Gadget::stockQuantity, &InputValidator::isValidQuantity> {
+        static constexpr const char* header = "STOCK";
+        static constexpr int width = 5;
+        static constexpr const char* name = "Stock Quantity";
+        static constexpr const char* prompt = "Enter stock quantity: ";
+        static constexpr Input input = Input::Number;
+        static constexpr int min = 0;
+        static constexpr int max = InputValidator::MAX_QUANTITY;
+    };
+
+    using Fields = FieldList<SerialNumber, Brand, Model, Category, Price, Color, StockQuantity>;
+
+    // Fields asked for when adding a gadget, in prompt order (the serial number is generated)
+    using InputFields = FieldList<Model, Category, Brand, Price, Color, StockQuantity>;
+
+    // Fields that can be changed after adding; the category fixes the serial number
+    using EditableFields = FieldList<Model, Brand, Color, Price, StockQuantity>;
+
+    // Call visit(FieldDescriptor{}) for every field in column order
+    template<typename Visitor>
+    static void forEachField(Visitor&& visit) { Fields::forEach(std::forward<Visitor>(visit)); }
+
+    // Call visit(FieldDescriptor{}) for every field prompted for by addGadget()
+    template<typename Visitor>
+    static void forEachInputField(Visitor&& visit) { InputFields::forEach(std::forward<Visitor>(visit)); }
+
+    // Call visit(FieldDescriptor{}) for every field offered by modifyGadget()
+    template<typename Visitor>
+    static void forEachEditableField(Visitor&& visit) { EditableFields::forEach(std::forward<Visitor>(visit)); }
+
+    // Check every field against its InputValidator rule
+    static bool isValid(const Gadget& gadget) { return Fields::isValid(gadget); }
+
+    static bool equal(const Gadget& a, const Gadget& b) { return Fields::equal(a, b); }
+
+    // Hash consistent with equal()
+    static size_t hash(const Gadget& gadget) { return Fields::hash(gadget); }
+
+    // Three-way comparison in column order, consistent with equal()
+    static int compare(const Gadget& a, const Gadget& b) { return Fields::compare(a, b); }
+
+    // Strict weak ordering for sorting, serial number first
+    static bool less(const Gadget& a, const Gadget& b) { return Fields::compare(a, b) < 0; }
+
+    // Append the binary encoding of a gadget to out
+    static void serialize(const Gadget& gadget, std::string& out) { Fields::serialize(gadget, out); }
+
+    // Decode a gadget starting at pos, advancing pos past it
+    static bool deserialize(const std::string& in, size_t& pos, Gadget& gadget) {
+        return Fields::deserialize(in, pos, gadget);
+    }
+};
+
+/*
+ * SearchCache Class: Bounded LRU cache of search results keyed by normalized query
+ * Entries are invalidated only when a changed gadget could match their search term
+ */
+class SearchCache {
+public:
+    // Which field a search matched on
+    enum class MatchType { None, Category, Brand, Model };
+
+    // Outcome of a single search
+    struct Result {
+        MatchType matchType = MatchType::None;
+        std::string category;           // Matched category name (category matches only)
+        std::vector<Gadget> gadgets;    // Matching gadgets in display order
+    };
+
+    // Results are shared and never modified once built, so a hit hands out the
+    // cached rows without copying them and an evicted result stays alive for
+    // whoever is still displaying it
+    using ResultPtr = std::shared_ptr<const Result>;
+
+    // Cache effectiveness counters
+    struct Stats {
+        size_t hits = 0;
+        size_t misses = 0;
+        size_t evictions = 0;
+        size_t invalidations = 0;
+        size_t oversized = 0;           // Results too large to cache at all
+
+        double hitRate() const {
+            size_t lookups = hits + misses;
+            return lookups == 0 ? 0.0 : static_cast<double>(hits) / lookups;
+        }
+    };
+
+    static constexpr size_t DEFAULT_CAPACITY = 64;
+    static constexpr size_t DEFAULT_MAX_ROWS = 100000;
+
+    // Bounded by entry count and by the total gadgets held across all entries;
+    // a capacity of 0 disables caching
+    explicit SearchCache(size_t capacity = DEFAULT_CAPACITY, size_t maxRows = DEFAULT_MAX_ROWS)
+        : capacity(capacity), maxRows(maxRows) {}
+
+    // Normalize a search term the same way the search compares it (uppercase)
+    static std::string normalize(const std::string& query) {
+        std::string key = query;
+        std::transform(key.begin(), key.end(), key.begin(), ::toupper);
+        return key;
+    }
+
+    // Look up a normalized query, marking it as most recently used
+    ResultPtr find(const std::string& key) {
+        auto it = index.find(key);
+        if (it == index.end()) {
+            ++stats.misses;
+            return nullptr;
+        }
+        ++stats.hits;
+        entries.splice(entries.begin(), entries, it->second);
+        return it->second->second;
+    }
+
+    // Cache the result of a normalized query, evicting least recently used entries
+    // until both limits hold. Results larger than the row limit are returned uncached
+    ResultPtr store(const std::string& key, Result result) {
+        ResultPtr shared = std::make_shared<const Result>(std::move(result));
+        if (capacity == 0) return shared;
+        if (shared->gadgets.size() > maxRows) {
+            ++stats.oversized;
+            return shared;
+        }
+
+        auto it = index.find(key);
+        if (it != index.end()) erase(it->second);
+
+        while (!entries.empty() &&
+               (entries.size() >= capacity || cachedRows + shared->gadgets.size() > maxRows)) {
+            erase(std::prev(entries.end()));
+            ++stats.evictions;
+        }
+        entries.emplace_front(key, shared);
+        index[key] = entries.begin();
+        cachedRows += shared->gadgets.size();
+        return shared;
+    }
+
+    // Drop cached queries whose term could match the gadget's brand, model or category
+    // Queries matching none of them cannot see the gadget, so they stay valid
+    void invalidate(const Gadget& gadget) {
+        invalidate(gadget, gadget);
+    }
+
+    // Same for a modified gadget, checking both its old and its new values
+    void invalidate(const Gadget& before, const Gadget& after) {
+        const std::string fields[] = {
+            normalize(before.getBrand()), normalize(before.getModel()), normalize(before.getCategory()),
+            normalize(after.getBrand()), normalize(after.getModel()), normalize(after.getCategory())
+        };
+
+        for (auto it = entries.begin(); it != entries.end();) {
+            const std::string& term = it->first;
+            bool matches = std::any_of(std::begin(fields), std::end(fields),
+                [&term](const std::string& field) { return field.find(term) != std::string::npos; });
+            if (matches) {
+                it = erase(it);
+                ++stats.invalidations;
+            } else {
+                ++it;
+            }
+        }
+    }
+
+    const Stats& getStats() const { return stats; }
+    size_t size() const { return entries.size(); }
+    size_t rows() const { return cachedRows; }
+
+private:
+    using Entry = std::pair<std::string, ResultPtr>;
+
+    std::list<Entry>::iterator erase(std::list<Entry>::iterator it) {
+        cachedRows -= it->second->gadgets.size();
+        index.erase(it->first);
+        return entries.erase(it);
+    }
+
+    size_t capacity;
+    size_t maxRows;
+    size_t cachedRows = 0;
+    std::list<Entry> entries;   // Most recently used first
+    std::unordered_map<std::string, std::list<Entry>::iterator> index;
+    Stats stats;
+};
+
+/*
+ * InventoryArchive Class: Compressed columnar history of inventory snapshots
+ * Every snapshot keeps one segment per category whose fields are stored as
+ * separate encoded columns, so a single column can be scanned across the whole
+ * history without restoring full snapshots
+ */
+class InventoryArchive {
+public:
+    // Archived stock of one gadget on one date
+    struct StockEntry {
+        int date = 0;
+        std::string category;
+        int stock = 0;
+    };
+
+    // Color ids are fixed by their position in the predefined color list
+    InventoryArchive() {
+        for (const auto& color : InputValidator::validColors) {
+            colors.idFor(color);
+        }
+    }
+
+    // Append a snapshot of the store taken on the given date (YYYYMMDD)
+    // A second snapshot for the latest date replaces it; returns true in that case
+    bool addSnapshot(int date, const std::map<std::string, std::vector<Gadget>>& gadgetsByCategory) {
+        Snapshot snapshot;
+        snapshot.date = date;
+
+        for (const auto& category : gadgetsByCategory) {
+            const auto& gadgets = category.second;
+            if (gadgets.empty()) continue;
+
+            Segment segment;
+            segment.categoryId = categories.idFor(category.first);
+            segment.serialPrefix = gadgets.front().getSerialNumber().substr(0, 2);
+            segment.rows = gadgets.size();
+
+            std::vector<long long> brandIds, modelIds, colorIds, prices, stocks, years, counters;
+            for (const auto& gadget : gadgets) {
+                brandIds.push_back(brands.idFor(gadget.getBrand()));
+                modelIds.push_back(models.idFor(gadget.getModel()));
+                colorIds.push_back(colors.idFor(gadget.getColor()));
+                prices.push_back(std::llround(gadget.getPrice() * 100));
+                stocks.push_back(gadget.getStockQuantity());
+
+                SerialParts serial = parseSerial(gadget.getSerialNumber());
+                years.push_back(serial.year);
+                counters.push_back(serial.counter);
+
+                snapshot.rawBytes += gadget.getModel().size() + gadget.getCategory().size() +
+                                     gadget.getSerialNumber().size() + gadget.getBrand().size() +
+                                     gadget.getColor().size() + sizeof(double) + sizeof(int);
+            }
+
+            segment.brand.encode(brandIds);
+            segment.model.encode(modelIds);
+            segment.color.encode(colorIds);
+            segment.price.encode(prices);
+            segment.stock.encode(stocks);
+            segment.serialYear.encode(years);
+            segment.serialCounter.encode(counters);
+            snapshot.segments.push_back(std::move(segment));
+        }
+
+        if (!snapshots.empty() && snapshots.back().date == date) {
+            snapshots.back() = std::move(snapshot);
+            return true;
+        }
+        snapshots.push_back(std::move(snapshot));
+        return false;
+    }
+
+    size_t snapshotCount() const { return snapshots.size(); }
+    int snapshotDate(size_t index) const { return snapshots[index].date; }
+
+    // Decode a whole snapshot back into the store layout (prices to the cent)
+    std::map<std::string, std::vector<Gadget>> restore(size_t index) const {
+        std::map<std::string, std::vector<Gadget>> gadgetsByCategory;
+
+        for (const auto& segment : snapshots[index].segments) {
+            const std::string& category = categories.values[segment.categoryId];
+            std::vector<long long> counters = segment.serialCounter.decode();
+            auto& gadgets = gadgetsByCategory[category];
+
+            for (size_t row = 0; row < segment.rows; ++row) {
+                gadgets.emplace_back(
+                    models.values[segment.model.at(row)],
+                    category,
+                    formatSerial(segment.serialPrefix, segment.serialYear.at(row), counters[row]),
+                    brands.values[segment.brand.at(row)],
+                    segment.price.at(row) / 100.0,
+                    colors.values[segment.color.at(row)],
+                    static_cast<int>(segment.stock.at(row)));
+            }
+        }
+        return gadgetsByCategory;
+    }
+
+    // Stock of one gadget in every snapshot that contains it
+    // Serial numbers are only unique within a category, so the category is part of
+    // the key and, like in the store, must match exactly. Only the serial and stock
+    // columns of that category's segments are read
+    std::vector<StockEntry> stockHistory(const std::string& category, const std::string& serialNumber) const {
+        std::vector<StockEntry> history;
+        auto categoryId = categories.ids.find(category);
+        if (serialNumber.length() < 5 || categoryId == categories.ids.end()) return history;
+
+        std::string prefix = serialNumber.substr(0, 2);
+        SerialParts serial = parseSerial(serialNumber);
+
+        for (const auto& snapshot : snapshots) {
+            for (const auto& segment : snapshot.segments) {
+                if (segment.categoryId != categoryId->second || segment.serialPrefix != prefix) continue;
+
+                std::vector<long long> counters = segment.serialCounter.decode();
+                auto it = std::find(counters.begin(), counters.end(), serial.counter);
+                while (it != counters.end() && segment.serialYear.at(it - counters.begin()) != serial.year) {
+                    it = std::find(it + 1, counters.end(), serial.counter);
+                }
+                if (it != counters.end()) {
+                    history.push_back({snapshot.date, category,
+                                       static_cast<int>(segment.stock.at(it - counters.begin()))});
+                }
+            }
+        }
+        return history;
+    }
+
+    // Total units in stock on each archived date, read from the stock column only
+    std::vector<std::pair<int, long long>> totalStockByDate() const {
+        std::vector<std::pair<int, long long>> totals;
+        for (const auto& snapshot : snapshots) {
+            long long total = 0;
+            for (const auto& segment : snapshot.segments) {
+                for (size_t row = 0; row < segment.rows; ++row) {
+                    total += segment.stock.at(row);
+                }
+            }
+            totals.emplace_back(snapshot.date, total);
+        }
+        return totals;
+    }
+
+    // Size of the same snapshots stored as plain field copies
+    size_t rawBytes() const {
+        size_t total = 0;
+        for (const auto& snapshot : snapshots) total += snapshot.rawBytes;
+        return total;
+    }
+
+    // Size of the archive as written by save()
+    size_t compressedBytes() const {
+        ByteCounter counter;
+        std::ostream out(&counter);
+        save(out);
+        return counter.count;
+    }
+
+    // Write the dictionaries and encoded segments to a binary stream
+    // Numbers are written in the machine's native byte order
+    bool save(std::ostream& out) const {
+        out.write(FILE_MAGIC, sizeof(FILE_MAGIC));
+        for (const Dictionary* dictionary : {&categories, &brands, &models, &colors}) {
+            writeValue(out, static_cast<uint32_t>(dictionary->values.size()));
+            for (const auto& value : dictionary->values) writeString(out, value);
+        }
+
+        writeValue(out, static_cast<uint64_t>(snapshots.size()));
+        for (const auto& snapshot : snapshots) {
+            writeValue(out, static_cast<int32_t>(snapshot.date));
+            writeValue(out, static_cast<uint64_t>(snapshot.rawBytes));
+            writeValue(out, static_cast<uint32_t>(snapshot.segments.size()));
+            for (const auto& segment : snapshot.segments) {
+                writeValue(out, segment.categoryId);
+                writeString(out, segment.serialPrefix);
+                writeValue(out, static_cast<uint64_t>(segment.rows));
+                for (const PackedColumn* column : segment.packedColumns()) {
+                    writeValue(out, static_cast<int64_t>(column->base));
+                    writeValue(out, static_cast<uint32_t>(column->bitWidth));
+                    writeVector(out, column->words);
+                }
+                writeVector(out, segment.serialCounter.data);
+            }
+        }
+        return static_cast<bool>(out);
+    }
+
+    // Replace this archive with one read by save(); on a malformed or truncated
+    // stream the archive is left unchanged and false is returned
+    bool load(std::istream& in) {
+        Reader reader(in);
+        InventoryArchive loaded;
+
+        char magic[sizeof(FILE_MAGIC)];
+        if (!reader.readBytes(magic, sizeof(magic)) ||
+            !std::equal(std::begin(magic), std::end(magic), std::begin(FILE_MAGIC))) {
+            return false;
+        }
+
+        for (Dictionary* dictionary : {&loaded.categories, &loaded.brands, &loaded.models, &loaded.colors}) {
+            uint32_t count;
+            if (!reader.read(count)) return false;
+            dictionary->values.clear();
+            dictionary->ids.clear();
+            for (uint32_t i = 0; i < count; ++i) {
+                std::string value;
+                if (!reader.readString(value)) return false;
+                dictionary->idFor(value);
+            }
+            if (dictionary->values.size() != count) return false;
+        }
+
+        uint64_t snapshotCount;
+        if (!reader.read(snapshotCount)) return false;
+        for (uint64_t i = 0; i < snapshotCount; ++i) {
+            Snapshot snapshot;
+            int32_t date;
+            uint64_t rawBytes;
+            uint32_t segmentCount;
+            if (!reader.read(date) || !reader.read(rawBytes) || !reader.read(segmentCount)) return false;
+            snapshot.date = date;
+            snapshot.rawBytes = rawBytes;
+
+            for (uint32_t j = 0; j < segmentCount; ++j) {
+                Segment segment;
+                uint64_t rows;
+                if (!reader.read(segment.categoryId) || !reader.readString(segment.serialPrefix) ||
+                    !reader.read(rows)) {
+                    return false;
+                }
+                segment.rows = rows;
+
+                for (PackedColumn* column : segment.packedColumns()) {
+                    int64_t base;
+                    uint32_t bitWidth;
+                    if (!reader.read(base) || !reader.read(bitWidth) || bitWidth > 64 ||
+                        !reader.readVector(column->words)) {
+                        return false;
+                    }
+                    column->base = base;
+                    column->bitWidth = bitWidth;
+                }
+                if (!reader.readVector(segment.serialCounter.data)) return false;
+
+                // Each serial takes at least one byte, which also bounds rows for the checks below
+                if (segment.serialCounter.data.size() < rows) return false;
+                for (const PackedColumn* column : segment.packedColumns()) {
+                    if (column->words.size() != (rows * column->bitWidth + 63) / 64) return false;
+                }
+
+                // Every id must resolve, and the serial column must hold one value per row
+                if (segment.categoryId >= loaded.categories.values.size() ||
+                    !idsWithin(segment.brand, rows, loaded.brands.values.size()) ||
+                    !idsWithin(segment.model, rows, loaded.models.values.size()) ||
+                    !idsWithin(segment.color, rows, loaded.colors.values.size()) ||
+                    segment.serialCounter.decode().size() != rows) {
+                    return false;
+                }
+                snapshot.segments.push_back(std::move(segment));
+            }
+            loaded.snapshots.push_back(std::move(snapshot));
+        }
+
+        *this = std::move(loaded);
+        return true;
+    }
+
+    double compressionRatio() const {
+        size_t compressed = compressedBytes();
+        return compressed == 0 ? 0.0 : static_cast<double>(rawBytes()) / compressed;
+    }
+
+private:
+    // Maps repeated strings to small integer ids shared by all snapshots
+    struct Dictionary {
+        std::vector<std::string> values;
+        std::unordered_map<std::string, uint32_t> ids;
+
+        uint32_t idFor(const std::string& value) {
+            auto it = ids.find(value);
+            if (it != ids.end()) return it->second;
+            uint32_t id = static_cast<uint32_t>(values.size());
+            values.push_back(value);
+            ids[value] = id;
+            return id;
+        }
+    };
+
+    // Frame-of-reference column: values stored as bit-packed offsets from the minimum
+    // Fixed-width offsets allow reading any single row directly
+    struct PackedColumn {
+        long long base = 0;
+        unsigned bitWidth = 0;
+        std::vector<uint64_t> words;
+
+        void encode(const std::vector<long long>& values) {
+            words.clear();
+            bitWidth = 0;
+            if (values.empty()) return;
+
+            base = *std::min_element(values.begin(), values.end());
+            uint64_t range = static_cast<uint64_t>(*std::max_element(values.begin(), values.end()) - base);
+            while (bitWidth < 64 && (range >> bitWidth) != 0) ++bitWidth;
+            if (bitWidth == 0) return;
+
+            words.assign((values.size() * bitWidth + 63) / 64, 0);
+            for (size_t i = 0; i < values.size(); ++i) {
+                uint64_t offset = static_cast<uint64_t>(values[i] - base);
+                size_t bitPos = i * bitWidth;
+                size_t word = bitPos / 64;
+                unsigned shift = bitPos % 64;
+                words[word] |= offset << shift;
+                if (shift + bitWidth > 64) {
+                    words[word + 1] |= offset >> (64 - shift);
+                }
+            }
+        }
+
+        long long at(size_t row) const {
+            if (bitWidth == 0) return base;
+
+            size_t bitPos = row * bitWidth;
+            size_t word = bitPos / 64;
+            unsigned shift = bitPos % 64;
+            uint64_t offset = words[word] >> shift;
+            if (shift + bitWidth > 64) {
+                offset |= words[word + 1] << (64 - shift);
+            }
+            if (bitWidth < 64) offset &= (uint64_t(1) << bitWidth) - 1;
+            return base + static_cast<long long>(offset);
+        }
+    };
+
+    // Delta column: differences between consecutive values as zigzag varints
+    // Sequential serial counters shrink to about one byte per row
+    struct DeltaColumn {
+        std::vector<uint8_t> data;
+
+        void encode(const std::vector<long long>& values) {
+            data.clear();
+            long long previous = 0;
+            for (long long value : values) {
+                long long delta = value - previous;
+                uint64_t zigzag = (static_cast<uint64_t>(delta) << 1) ^ static_cast<uint64_t>(delta >> 63);
+                while (zigzag >= 0x80) {
+                    data.push_back(static_cast<uint8_t>(zigzag | 0x80));
+                    zigzag >>= 7;
+                }
+                data.push_back(static_cast<uint8_t>(zigzag));
+                previous = value;
+            }
+        }
+
+        std::vector<long long> decode() const {
+            std::vector<long long> values;
+            long long previous = 0;
+            uint64_t zigzag = 0;
+            unsigned shift = 0;
+            for (uint8_t byte : data) {
+                zigzag |= static_cast<uint64_t>(byte & 0x7F) << shift;
+                shift += 7;
+                if (byte & 0x80) continue;
+
+                long long delta = static_cast<long long>(zigzag >> 1) ^ -static_cast<long long>(zigzag & 1);
+                previous += delta;
+                values.push_back(previous);
+                zigzag = 0;
+                shift = 0;
+            }
+            return values;
+        }
+    };
+
+    // One category of one snapshot
+    struct Segment {
+        uint32_t categoryId = 0;
+        std::string serialPrefix;       // First two letters shared by the category's serials
+        size_t rows = 0;
+        PackedColumn brand;
+        PackedColumn model;
+        PackedColumn color;
+        PackedColumn price;             // In cents
+        PackedColumn stock;
+        PackedColumn serialYear;
+        DeltaColumn serialCounter;
+
+        // Fixed-width columns in file order
+        std::vector<PackedColumn*> packedColumns() {
+            return {&brand, &model, &color, &price, &stock, &serialYear};
+        }
+        std::vector<const PackedColumn*> packedColumns() const {
+            return {&brand, &model, &color, &price, &stock, &serialYear};
+        }
+    };
+
+    struct Snapshot {
+        int date = 0;
+        size_t rawBytes = 0;
+        std::vector<Segment> segments;
+    };
+
+    // Year and sequence number of a CCYYNNNNN serial number
+    struct SerialParts {
+        long long year = 0;
+        long long counter = 0;
+    };
+
+    static SerialParts parseSerial(const std::string& serialNumber) {
+        SerialParts parts;
+        if (serialNumber.length() < 5) return parts;
+        try {
+            parts.year = std::stoll(serialNumber.substr(2, 2));
+            parts.counter = std::stoll(serialNumber.substr(4));
+        } catch (...) {
+            parts = SerialParts();
+        }
+        return parts;
+    }
+
+    static constexpr char FILE_MAGIC[8] = {'G', 'S', 'A', 'R', 'C', 'H', 'V', '1'};
+
+    // Stream buffer that only counts the bytes written to it
+    struct ByteCounter : std::streambuf {
+        size_t count = 0;
+
+        int_type overflow(int_type ch) override {
+            ++count;
+            return traits_type::not_eof(ch);
+        }
+
+        std::streamsize xsputn(const char*, std::streamsize n) override {
+            count += static_cast<size_t>(n);
+            return n;
+        }
+    };
+
+    // Reads values back while tracking how many bytes the stream has left, so a
+    // corrupt length can't trigger a huge allocation
+    struct Reader {
+        std::istream& in;
+        uint64_t remaining = 0;
+
+        explicit Reader(std::istream& in) : in(in) {
+            std::streampos start = in.tellg();
+            if (start != std::streampos(-1) && in.seekg(0, std::ios::end)) {
+                remaining = static_cast<uint64_t>(in.tellg() - start);
+                in.seekg(start);
+            }
+            in.clear();
+        }
+
+        bool readBytes(char* data, uint64_t size) {
+            if (size > remaining || !in.read(data, static_cast<std::streamsize>(size))) return false;
+            remaining -= size;
+            return true;
+        }
+
+        template<typename T>
+        bool read(T& value) { return readBytes(reinterpret_cast<char*>(&value), sizeof(T)); }
+
+        bool readString(std::string& value) {
+            uint32_t length;
+            if (!read(length) || length > remaining) return false;
+            value.resize(length);
+            return readBytes(&value[0], length);
+        }
+
+        template<typename T>
+        bool readVector(std::vector<T>& values) {
+            uint64_t count;
+            if (!read(count) || count > remaining / sizeof(T)) return false;
+            values.resize(static_cast<size_t>(count));
+            return readBytes(reinterpret_cast<char*>(values.data()), count * sizeof(T));
+        }
+    };
+
+    template<typename T>
+    static void writeValue(std::ostream& out, const T& value) {
+        out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    static void writeString(std::ostream& out, const std::string& value) {
+        writeValue(out, static_cast<uint32_t>(value.size()));
+        out.write(value.data(), static_cast<std::streamsize>(value.size()));
+    }
+
+    template<typename T>
+    static void writeVector(std::ostream& out, const std::vector<T>& values) {
+        writeValue(out, static_cast<uint64_t>(values.size()));
+        out.write(reinterpret_cast<const char*>(values.data()),
+                  static_cast<std::streamsize>(values.size() * sizeof(T)));
+    }
+
+    // Whether every row of a dictionary-encoded column is a valid id
+    static bool idsWithin(const PackedColumn& column, uint64_t rows, size_t dictionarySize) {
+        for (uint64_t row = 0; row < rows; ++row) {
+            long long id = column.at(static_cast<size_t>(row));
+            if (id < 0 || static_cast<size_t>(id) >= dictionarySize) return false;
+        }
+        return true;
+    }
+
+    static std::string formatSerial(const std::string& prefix, long long year, long long counter) {
+        std::stringstream ss;
+        ss << prefix
+           << std::setfill('0') << std::setw(2) << year
+           << std::setfill('0') << std::setw(5) << counter;
+        return ss.str();
+    }
+
+    Dictionary categories;
+    Dictionary brands;
+    Dictionary models;
+    Dictionary colors;
+    std::vector<Snapshot> snapshots;
+};
+
+/*
+ * ParallelScan Class: Parallel filter and map/reduce over the whole catalog
+ * The catalog is cut into equal-sized morsels that may span several categories,
+ * so skewed category sizes still spread evenly across threads. A persistent
+ * pool of workers claims the next morsel from a shared counter, and per-morsel
+ * results are merged in morsel order, which is the same order as a serial
+ * category walk
+ */
+class ParallelScan {
+public:
+    using Catalog = std::map<std::string, std::vector<Gadget>>;
+
+    static constexpr size_t MORSEL_SIZE = 16384;
+    static constexpr size_t MIN_PARALLEL_ITEMS = 65536;   // Smaller catalogs are scanned serially
+
+    // Copies of the gadgets matching predicate, in catalog order
+    template<typename Predicate>
+    static std::vector<Gadget> filter(const Catalog& catalog, Predicate predicate) {
+        std::vector<Morsel> morsels = split(catalog);
+        std::vector<std::vector<Gadget>> partials(morsels.size());
+
+        run(morsels.size(), [&](size_t index) {
+            for (const auto& span : morsels[index]) {
+                for (const Gadget* gadget = span.first; gadget != span.second; ++gadget) {
+                    if (predicate(*gadget)) partials[index].push_back(*gadget);
+                }
+            }
+        });
+
+        size_t total = 0;
+        for (const auto& partial : partials) total += partial.size();
+
+        std::vector<Gadget> results;
+        results.reserve(total);
+        for (auto& partial : partials) {
+            std::move(partial.begin(), partial.end(), std::back_inserter(results));
+        }
+        return results;
+    }
+
+    // Fold map(gadget) into identity with reduce, combining partials in catalog order
+    // reduce must be associative for the result to match a serial fold
+    template<typename T, typename Map, typename Reduce>
+    static T mapReduce(const Catalog& catalog, T identity, Map map, Reduce reduce) {
+        std::vector<Morsel> morsels = split(catalog);
+        std::vector<Partial<T>> partials(morsels.size(), Partial<T>{identity});
+
+        run(morsels.size(), [&](size_t index) {
+            T& partial = partials[index].value;
+            for (const auto& span : morsels[index]) {
+                for (const Gadget* gadget = span.first; gadget != span.second; ++gadget) {
+                    partial = reduce(partial, map(*gadget));
+                }
+            }
+        });
+
+        T result = identity;
+        for (const auto& partial : partials) result = reduce(result, partial.value);
+        return result;
+    }
+
+    // Cap the number of threads (including the caller) used by later scans
+    static void setThreadLimit(size_t limit) {
+        WorkerPool::instance().setThreadLimit(limit);
+    }
+
+    // Threads available to a scan: the pool's workers plus the calling thread
+    static size_t threadCount() {
+        return WorkerPool::instance().size();
+    }
+
+private:
+    // A morsel is a list of [begin, end) ranges inside category vectors
+    using Span = std::pair<const Gadget*, const Gadget*>;
+    using Morsel = std::vector<Span>;
+
+    // Per-morsel reduction slot; a plain std::vector<bool> would pack
+    // neighbouring morsels into one word and race
+    template<typename T>
+    struct Partial {
+        T value;
+    };
+
+    /*
+     * Worker threads started on first use and kept until program exit
+     * The calling thread takes part in every scan, so the pool still works,
+     * serially, if no worker thread could be started
+     */
+    class WorkerPool {
+    public:
+        static WorkerPool& instance() {
+            static WorkerPool pool;
+            return pool;
+        }
+
+        size_t size() const { return workers.size() + 1; }
+
+        void setThreadLimit(size_t limit) { threadLimit = std::max<size_t>(limit, 1); }
+
+        // Run work(index) for every index below count and wait for all workers
+        // The first exception thrown by a work item is rethrown on the caller
+        void run(size_t count, const std::function<void(size_t)>& work) {
+            std::lock_guard<std::mutex> scanLock(scanMutex);
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                job = &work;
+                jobSize = count;
+                next = 0;
+                error = nullptr;
+                activeThreads = std::min(threadLimit.load(), size());
+                busy = workers.size();
+                ++generation;
+            }
+            wake.notify_all();
+
+            drain();
+
+            std::unique_lock<std::mutex> lock(mutex);
+            done.wait(lock, [this] { return busy == 0; });
+            job = nullptr;
+            if (error) {
+                std::exception_ptr failure = error;
+                error = nullptr;
+                std::rethrow_exception(failure);
+            }
+        }
+
+    private:
+        WorkerPool() {
+            size_t hardwareThreads = std::max(1u, std::thread::hardware_concurrency());
+            try {
+                for (size_t id = 0; id + 1 < hardwareThreads; ++id) {
+                    workers.emplace_back(&WorkerPool::workerLoop, this, id);
+                }
+            } catch (const std::system_error&) {
+                // Keep the workers that did start; the caller covers the rest
+            }
+        }
+
+        ~WorkerPool() {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                stopping = true;
+            }
+            wake.notify_all();
+            for (auto& worker : workers) worker.join();
+        }
+
+        WorkerPool(const WorkerPool&) = delete;
+        WorkerPool& operator=(const WorkerPool&) = delete;
+
+        // Claim and run work items until none are left or one has failed
+        void drain() {
+            for (size_t index = next++; index < jobSize; index = next++) {
+                try {
+                    (*job)(index);
+                } catch (...) {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    if (!error) error = std::current_exception();
+                    next = jobSize;
+                }
+            }
+        }
+
+        void workerLoop(size_t id) {
+            size_t seenGeneration = 0;
+            while (true) {
+                {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    wake.wait(lock, [&] { return stopping || generation != seenGeneration; });
+                    if (stopping) return;
+                    seenGeneration = generation;
+                }
+
+                // Worker id + 1 because the calling thread is thread 0
+                if (id + 1 < activeThreads) drain();
+
+                std::lock_guard<std::mutex> lock(mutex);
+                if (--busy == 0) done.notify_one();
+            }
+        }
+
+        std::vector<std::thread> workers;
+        std::mutex scanMutex;               // One scan at a time; scans must not nest
+        std::mutex mutex;
+        std::condition_variable wake;
+        std::condition_variable done;
+
+        const std::function<void(size_t)>* job = nullptr;
+        size_t jobSize = 0;
+        std::atomic<size_t> next{0};
+        std::exception_ptr error;
+        size_t activeThreads = 1;
+        size_t busy = 0;
+        size_t generation = 0;
+        bool stopping = false;
+        std::atomic<size_t> threadLimit{SIZE_MAX};
+    };
+
+    // Cut the catalog into MORSEL_SIZE pieces, crossing category boundaries
+    // Small catalogs become a single morsel so they are scanned on this thread
+    static std::vector<Morsel> split(const Catalog& catalog) {
+        size_t totalItems = 0;
+        for (const auto& category : catalog) totalItems += category.second.size();
+        size_t morselSize = totalItems < MIN_PARALLEL_ITEMS ? std::max<size_t>(totalItems, 1) : MORSEL_SIZE;
+
+        std::vector<Morsel> morsels(1);
+        size_t filled = 0;
+        for (const auto& category : catalog) {
+            const Gadget* begin = category.second.data();
+            const Gadget* end = begin + category.second.size();
+            while (begin != end) {
+                if (filled == morselSize) {
+                    morsels.emplace_back();
+                    filled = 0;
+                }
+                size_t take = std::min<size_t>(morselSize - filled, end - begin);
+                morsels.back().emplace_back(begin, begin + take);
+                begin += take;
+                filled += take;
+            }
+        }
+        return morsels;
+    }
+
+    // Run work(index) for every morsel index, on the worker pool when there is
+    // more than one morsel
+    template<typename Work>
+    static void run(size_t morselCount, Work work) {
+        if (morselCount == 1) {
+            work(0);
+            return;
+        }
+        WorkerPool::instance().run(morselCount, work);
+    }
+};
+
 /*
  * GadgetStore Class: Manages the entire gadget store operations
  * Handles all CRUD operations and user interface
@@ -338,6 +1479,13 @@ private:
     // Serial number tracking
     std::map<std::string, int> categoryCounters;
 
+    // Results of recent searches, invalidated on add/modify/delete
+    mutable SearchCache searchCache;
+
+    // Compressed history of archived inventory snapshots, kept in ARCHIVE_FILE
+    InventoryArchive archive;
+    static constexpr const char* ARCHIVE_FILE = "inventory_archive.gsa";
+
     // Helper function to get input
     std::string getInput(const std::string& prompt) const {
         std::cout << prompt;
@@ -402,91 +1550,150 @@ private:
             [](char c) { return std::isdigit(c); });
     }
 
-    // Displays gadgets in a formatted table
+    // Read one GadgetSchema field from the console using its input kind and rule
+    // Returns nullopt for empty input, or on end of input
+    template<typename Field>
+    static std::optional<typename Field::Type> readField(const std::string& prompt, bool allowEmpty) {
+        if constexpr (Field::input == GadgetSchema::Input::Number) {
+            return InputValidator::getValidNumericInput(prompt, Field::min, Field::max);
+        } else {
+            std::string input;
+            if constexpr (Field::input == GadgetSchema::Input::Color) {
+                input = InputValidator::getValidColorInput(prompt, allowEmpty);
+            } else {
+                input = InputValidator::getValidInput(prompt, Field::accepts, Field::errorMessage(), allowEmpty);
+            }
+            if (input.empty()) return std::nullopt;
+            return input;
+        }
+    }
+
+    // Displays gadgets in a formatted table, one column per GadgetSchema field
     void displayGadgetTable(const std::vector<Gadget>& gadgets) const {
         std::cout << std::string(100, '-') << '\n';
-        std::cout << std::left 
-                  << std::setw(8) << "SERIAL#" << " | "
-                  << std::setw(15) << "BRAND" << " | "
-                  << std::setw(15) << "MODEL" << " | "
-                  << std::setw(10) << "CATEGORY" << " | "
-                  << std::setw(8) << "PRICE" << " | "
-                  << std::setw(10) << "COLOR" << " | "
-                  << std::setw(5) << "STOCK" << '\n';
+        bool firstColumn = true;
+        GadgetSchema::forEachField([&](auto field) {
+            using Field = decltype(field);
+            if (!firstColumn) std::cout << " | ";
+            firstColumn = false;
+            std::cout << std::left << std::setw(Field::width) << Field::header;
+        });
+        std::cout << '\n';
         std::cout << std::string(100, '-') << '\n';
 
         for (const auto& gadget : gadgets) {
-            std::cout << std::left
-                      << std::setw(8) << toUpper(gadget.getSerialNumber()) << " | "
-                      << std::setw(15) << toUpper(gadget.getBrand()) << " | "
-                      << std::setw(15) << toUpper(gadget.getModel()) << " | "
-                      << std::setw(10) << toUpper(gadget.getCategory()) << " | "
-                      << std::setw(8) << std::fixed << std::setprecision(2) << gadget.getPrice() << " | "
-                      << std::setw(10) << toUpper(gadget.getColor()) << " | "
-                      << std::setw(5) << gadget.getStockQuantity() << '\n';
+            firstColumn = true;
+            GadgetSchema::forEachField([&](auto field) {
+                using Field = decltype(field);
+                if (!firstColumn) std::cout << " | ";
+                firstColumn = false;
+                std::cout << std::left << std::setw(Field::width);
+                if constexpr (std::is_same_v<typename Field::Type, std::string>) {
+                    std::cout << toUpper(Field::get(gadget));
+                } else if constexpr (std::is_same_v<typename Field::Type, double>) {
+                    std::cout << std::fixed << std::setprecision(2) << Field::get(gadget);
+                } else {
+                    std::cout << Field::get(gadget);
+                }
+            });
+            std::cout << '\n';
         }
         std::cout << std::string(100, '-') << '\n';
     }
 
+    // Search categories first, then brands, then models for a normalized term
+    SearchCache::Result findGadgets(const std::string& searchTerm) const {
+        SearchCache::Result result;
+
+        // Search in categories first
+        for (const auto& category : gadgetsByCategory) {
+            if (toUpper(category.first).find(searchTerm) != std::string::npos) {
+                result.matchType = SearchCache::MatchType::Category;
+                result.category = category.first;
+                result.gadgets = category.second;
+                return result;
+            }
+        }
+
+        // Then search in brands
+        result.gadgets = ParallelScan::filter(gadgetsByCategory, [&](const Gadget& gadget) {
+            return toUpper(gadget.getBrand()).find(searchTerm) != std::string::npos;
+        });
+
+        if (!result.gadgets.empty()) {
+            result.matchType = SearchCache::MatchType::Brand;
+            return result;
+        }
+
+        // Finally search in models
+        result.gadgets = ParallelScan::filter(gadgetsByCategory, [&](const Gadget& gadget) {
+            return toUpper(gadget.getModel()).find(searchTerm) != std::string::npos;
+        });
+
+        if (!result.gadgets.empty()) {
+            result.matchType = SearchCache::MatchType::Model;
+        }
+        return result;
+    }
+
 public:
     // Initialize random number generator
-    GadgetStore() {}
+    explicit GadgetStore(size_t searchCacheCapacity = SearchCache::DEFAULT_CAPACITY,
+                         size_t searchCacheMaxRows = SearchCache::DEFAULT_MAX_ROWS)
+        : searchCache(searchCacheCapacity, searchCacheMaxRows) {}
 
     // Add new gadget to the store with user input
     void addGadget() {
         displayHeader("ADD NEW GADGET");
         
-        // Get model
-        std::string model = InputValidator::getValidInput(
-            "Enter gadget model: ",
-            InputValidator::isValidModel,
-            ErrorMessages::modelLength(InputValidator::MAX_TEXT_LENGTH) + "\n" + 
-            ErrorMessages::modelFormat()
-        );
-
-        // Get category
-        std::string category = InputValidator::getValidInput(
-            "Enter gadget category: ",
-            InputValidator::isValidCategory,
-            ErrorMessages::categoryFormat() + "\n" + 
-            ErrorMessages::categoryLength(InputValidator::MAX_TEXT_LENGTH)
-        );
-
-        // Get brand
-        std::string brand = InputValidator::getValidInput(
-            "Enter brand name: ",
-            InputValidator::isValidBrand,
-            ErrorMessages::brandLength(InputValidator::MAX_TEXT_LENGTH) + "\n" + 
-            ErrorMessages::brandFormat()
-        );
-        
-        // Get price
-        double price = 0.0;
-        auto priceInput = InputValidator::getValidNumericInput(
-            "Enter price: ", 0.0, InputValidator::MAX_PRICE
-        );
-        if (priceInput) price = *priceInput;
-        
-        // Get color
-        std::string color = InputValidator::getValidColorInput("Enter color: ");
-        
-        // Get quantity
-        int quantity = 0;
-        auto quantityInput = InputValidator::getValidNumericInput(
-            "Enter stock quantity: ", 0, InputValidator::MAX_QUANTITY
-        );
-        if (quantityInput) quantity = *quantityInput;
-
-        std::string serialNumber = generateSerialNumber(category);
-        Gadget gadget(model, category, serialNumber, brand, price, color, quantity);
-        gadgetsByCategory[category].push_back(gadget);
+        Gadget gadget;
+        GadgetSchema::forEachInputField([&](auto field) {
+            using Field = decltype(field);
+            auto value = readField<Field>(Field::prompt, false);
+            if (value) Field::set(gadget, *value);
+        });
+
+        std::string serialNumber = addGadget(gadget);
         
-        std::cout << "\nGadget added successfully!\n";
-        std::cout << "Generated Serial Number: " << serialNumber << "\n";
+        if (serialNumber.empty()) {
+            std::cout << "\nGadget could not be added: every field is required.\n";
+        } else {
+            std::cout << "\nGadget added successfully!\n";
+            std::cout << "Generated Serial Number: " << serialNumber << "\n";
+        }
         std::cout << "\nPress Enter to continue...";
         std::cin.get();
     }
 
+    // Add a gadget and return its generated serial number
+    // Returns an empty string if any field fails its GadgetSchema rule
+    std::string addGadget(const std::string& model, const std::string& category,
+                          const std::string& brand, double price,
+                          const std::string& color, int quantity) {
+        return addGadget(Gadget(model, category, "", brand, price, color, quantity));
+    }
+
+    // Add a gadget built from user input, replacing any serial number it carries
+    std::string addGadget(Gadget gadget) {
+        gadget.setSerialNumber("");
+        if (!GadgetSchema::isValid(gadget)) return "";
+
+        std::string serialNumber = generateSerialNumber(gadget.getCategory());
+        gadget.setSerialNumber(serialNumber);
+        gadgetsByCategory[gadget.getCategory()].push_back(gadget);
+        searchCache.invalidate(gadget);
+        return serialNumber;
+    }
+
+    // Search result for a term, served from the cache when possible
+    SearchCache::ResultPtr search(const std::string& searchTerm) const {
+        const std::string key = SearchCache::normalize(searchTerm);
+        if (SearchCache::ResultPtr cached = searchCache.find(key)) {
+            return cached;
+        }
+        return searchCache.store(key, findGadgets(key));
+    }
+
     // Search for gadgets by category, brand, or model
     void searchGadget() const {
         displayHeader("SEARCH GADGET");
@@ -499,61 +1706,47 @@ public:
             return;
         }
 
-        std::vector<Gadget> results;
-        
-        // Search in categories first
-        for (const auto& category : gadgetsByCategory) {
-            if (toUpper(category.first).find(searchTerm) != std::string::npos) {
-                std::cout << "\nFound gadgets in category '" << toUpper(category.first) << "':\n\n";
-                displayGadgetTable(category.second);
-                std::cout << "\nPress Enter to continue...";
-                std::cin.get();
-                return;
-            }
-        }
-
-        // Then search in brands
-        bool foundBrand = false;
-        for (const auto& category : gadgetsByCategory) {
-            for (const auto& gadget : category.second) {
-                if (toUpper(gadget.getBrand()).find(searchTerm) != std::string::npos) {
-                    if (!foundBrand) {
-                        std::cout << "\nFound gadgets of brand '" << toUpper(searchTerm) << "':\n\n";
-                        foundBrand = true;
-                    }
-                    results.push_back(gadget);
-                }
-            }
+        const SearchCache::ResultPtr found = search(searchTerm);
+        const SearchCache::Result& result = *found;
+
+        switch (result.matchType) {
+            case SearchCache::MatchType::Category:
+                std::cout << "\nFound gadgets in category '" << toUpper(result.category) << "':\n\n";
+                displayGadgetTable(result.gadgets);
+                break;
+            case SearchCache::MatchType::Brand:
+                std::cout << "\nFound gadgets of brand '" << toUpper(searchTerm) << "':\n\n";
+                displayGadgetTable(result.gadgets);
+                break;
+            case SearchCache::MatchType::Model:
+                std::cout << "\nFound " << result.gadgets.size() << " matching gadget(s) by model:\n\n";
+                displayGadgetTable(result.gadgets);
+                break;
+            case SearchCache::MatchType::None:
+                std::cout << "\nNo gadgets found matching your search.\n";
+                break;
         }
 
-        if (foundBrand) {
-            displayGadgetTable(results);
-            std::cout << "\nPress Enter to continue...";
-            std::cin.get();
-            return;
-        }
-
-        // Finally search in models
-        results.clear();
-        for (const auto& category : gadgetsByCategory) {
-            for (const auto& gadget : category.second) {
-                if (toUpper(gadget.getModel()).find(searchTerm) != std::string::npos) {
-                    results.push_back(gadget);
-                }
-            }
-        }
-        
-        if (results.empty()) {
-            std::cout << "\nNo gadgets found matching your search.\n";
-        } else {
-            std::cout << "\nFound " << results.size() << " matching gadget(s) by model:\n\n";
-            displayGadgetTable(results);
-        }
+        const SearchCache::Stats& stats = getSearchCacheStats();
+        std::stringstream hitRate;
+        hitRate << std::fixed << std::setprecision(1) << stats.hitRate() * 100;
+        std::cout << "\nSearch cache: " << stats.hits << " hit(s), " << stats.misses << " miss(es), "
+                  << hitRate.str() << "% hit rate, " << stats.evictions << " eviction(s)\n";
         
         std::cout << "\nPress Enter to continue...";
         std::cin.get();
     }
 
+    // Hit-rate and eviction counters of the search result cache
+    const SearchCache::Stats& getSearchCacheStats() const {
+        return searchCache.getStats();
+    }
+
+    // Gadgets currently held by the search result cache
+    size_t getSearchCacheRows() const {
+        return searchCache.rows();
+    }
+
     // Delete a gadget using its serial number
     bool deleteGadget() {
         while (true) {
@@ -583,6 +1776,7 @@ public:
                 auto& gadgets = category.second;
                 for (auto it = gadgets.begin(); it != gadgets.end(); ++it) {
                     if (toUpper(it->getSerialNumber()) == serialNumber) {
+                        searchCache.invalidate(*it);
                         gadgets.erase(it);
                         
                         // Remove the category if it's empty
@@ -642,40 +1836,24 @@ public:
                         
                         std::cout << "\nEnter new details (press Enter to keep current value):\n";
                         
-                        std::string input;
-                        
-                        input = InputValidator::getValidInput(
-                            "Model [" + gadget.getModel() + "]: ",
-                            InputValidator::isValidModel,
-                            ErrorMessages::modelLength(InputValidator::MAX_TEXT_LENGTH) + "\n" + 
-                            ErrorMessages::modelFormat()
-                        );
-                        if (!input.empty()) gadget.setModel(input);
-                        
-                        input = InputValidator::getValidInput(
-                            "Brand [" + gadget.getBrand() + "]: ",
-                            InputValidator::isValidBrand,
-                            ErrorMessages::brandLength(InputValidator::MAX_TEXT_LENGTH) + "\n" + 
-                            ErrorMessages::brandFormat()
-                        );
-                        if (!input.empty()) gadget.setBrand(input);
+                        GadgetSchema::forEachEditableField([&](auto field) {
+                            using Field = decltype(field);
+                            std::string current;
+                            if constexpr (std::is_same_v<typename Field::Type, double>) {
+                                current = InputValidator::formatPrice(Field::get(gadget));
+                            } else if constexpr (std::is_same_v<typename Field::Type, int>) {
+                                current = std::to_string(Field::get(gadget));
+                            } else {
+                                current = Field::get(gadget);
+                            }
+                            auto value = readField<Field>(std::string(Field::name) + " [" + current + "]: ", true);
+                            if (value) Field::set(gadget, *value);
+                        });
                         
-                        input = InputValidator::getValidColorInput(
-                            "Color [" + gadget.getColor() + "]: "
-                        );
-                        if (!input.empty()) gadget.setColor(input);
-                        
-                        auto priceInput = InputValidator::getValidNumericInput(
-                            "Price [" + InputValidator::formatPrice(gadget.getPrice()) + "]: ",
-                            0.0, InputValidator::MAX_PRICE
-                        );
-                        if (priceInput) gadget.setPrice(*priceInput);
-                        
-                        auto quantityInput = InputValidator::getValidNumericInput(
-                            "Stock Quantity [" + std::to_string(gadget.getStockQuantity()) + "]: ",
-                            0, InputValidator::MAX_QUANTITY
-                        );
-                        if (quantityInput) gadget.setStockQuantity(*quantityInput);
+                        // Searches matching either the old or the new values are stale
+                        if (!GadgetSchema::equal(currentGadget.front(), gadget)) {
+                            searchCache.invalidate(currentGadget.front(), gadget);
+                        }
                         
                         std::cout << "\nNote: Category cannot be modified. Create a new gadget with the desired category.\n";
                         
@@ -709,12 +1887,96 @@ public:
                 displayGadgetTable(category.second);
                 std::cout << '\n';
             }
+
+            // Total units and stock value across the whole catalog
+            using Valuation = std::pair<long long, double>;
+            Valuation valuation = ParallelScan::mapReduce(
+                gadgetsByCategory, Valuation(0, 0.0),
+                [](const Gadget& gadget) {
+                    return Valuation(gadget.getStockQuantity(),
+                                     gadget.getPrice() * gadget.getStockQuantity());
+                },
+                [](const Valuation& a, const Valuation& b) {
+                    return Valuation(a.first + b.first, a.second + b.second);
+                });
+            std::cout << "Total stock: " << valuation.first << " unit(s), valued at "
+                      << InputValidator::formatPrice(valuation.second) << '\n';
         }
         
         std::cout << "\nPress Enter to continue...";
         std::cin.get();
     }
 
+    // Load archived snapshots saved by earlier sessions, if any
+    void loadArchive() {
+        std::ifstream file(ARCHIVE_FILE, std::ios::binary);
+        if (file && !archive.load(file)) {
+            std::cout << "Warning: " << ARCHIVE_FILE << " is damaged and was not loaded.\n";
+        }
+    }
+
+    // Archive the current inventory as today's snapshot
+    void archiveSnapshot() {
+        displayHeader("ARCHIVE INVENTORY SNAPSHOT");
+
+        std::time_t now = std::time(nullptr);
+        std::tm* ltm = std::localtime(&now);
+        int date = (ltm->tm_year + 1900) * 10000 + (ltm->tm_mon + 1) * 100 + ltm->tm_mday;
+
+        if (archive.addSnapshot(date, gadgetsByCategory)) {
+            std::cout << "\nSnapshot for " << date << " replaced with the current inventory.\n";
+        } else {
+            std::cout << "\nSnapshot " << archive.snapshotCount() << " archived for " << date << ".\n";
+        }
+
+        std::ofstream file(ARCHIVE_FILE, std::ios::binary | std::ios::trunc);
+        if (!file || !archive.save(file)) {
+            std::cout << "Could not write " << ARCHIVE_FILE << "; the snapshot is kept for this session only.\n";
+        } else {
+            file.close();
+            std::stringstream ratio;
+            ratio << std::fixed << std::setprecision(2) << archive.compressionRatio();
+            std::cout << "Saved to " << ARCHIVE_FILE << ": " << archive.compressedBytes() << " bytes ("
+                      << archive.rawBytes() << " bytes uncompressed, ratio " << ratio.str() << ")\n";
+        }
+        std::cout << "\nPress Enter to continue...";
+        std::cin.get();
+    }
+
+    // Show the archived stock of one gadget over time
+    void viewStockHistory() const {
+        displayHeader("STOCK HISTORY");
+
+        if (archive.snapshotCount() == 0) {
+            std::cout << "\nNo archived snapshots!\n";
+            std::cout << "\nPress Enter to continue...";
+            std::cin.get();
+            return;
+        }
+
+        std::string category = getInput("Enter gadget category: ");
+        std::string serialNumber = toUpper(getInput("Enter gadget serial number: "));
+        auto history = archive.stockHistory(category, serialNumber);
+
+        if (history.empty()) {
+            std::cout << "\nNo archived stock found for this gadget.\n";
+        } else {
+            std::cout << "\n" << std::string(33, '-') << '\n';
+            std::cout << std::left << std::setw(10) << "DATE" << " | "
+                      << std::setw(10) << "CATEGORY" << " | " << std::setw(5) << "STOCK" << '\n';
+            std::cout << std::string(33, '-') << '\n';
+            for (const auto& entry : history) {
+                std::cout << std::left << std::setw(10) << entry.date << " | "
+                          << std::setw(10) << entry.category << " | "
+                          << std::setw(5) << entry.stock << '\n';
+            }
+            std::cout << std::string(33, '-') << '\n';
+        }
+
+        std::cout << "\nPress Enter to continue...";
+        std::cin.get();
+    }
+
     // Display main menu options
     void displayMenu() const {
         displayHeader("GADGET STORE MANAGEMENT SYSTEM");
@@ -723,12 +1985,16 @@ public:
         std::cout << "\n3. Delete Gadget";
         std::cout << "\n4. Modify Gadget";
         std::cout << "\n5. List All Gadgets";
-        std::cout << "\n6. Exit";
-        std::cout << "\n\nEnter your choice (1-6): ";
+        std::cout << "\n6. Archive Inventory Snapshot";
+        std::cout << "\n7. View Stock History";
+        std::cout << "\n8. Exit";
+        std::cout << "\n\nEnter your choice (1-8): ";
     }
 
     // Main program loop
     void run() {
+        loadArchive();
+
         while (true) {
             displayMenu();
             std::string choice = getInput("");
@@ -750,6 +2016,12 @@ public:
                     listGadgets();
                     break;
                 case '6':
+                    archiveSnapshot();
+                    break;
+                case '7':
+                    viewStockHistory();
+                    break;
+                case '8':
                     std::cout << "\nThank you for using Gadget Store Management System!\n";
                     return;
                 default:
@@ -760,9 +2032,11 @@ public:
     }
 };
 
-// Program entry point
+// Program entry point (left out when the benchmarks include this file)
+#ifndef GADGETSTORE_NO_MAIN
 int main() {
     GadgetStore store;
     store.run();
     return 0;
 }
+#endif
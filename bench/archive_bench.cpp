@@ -0,0 +1,162 @@
+// Inventory archive benchmark
+// Archives a year of daily snapshots of a skewed synthetic catalog and reports
+// saved archive size and compression ratio, archiving and save/load time, and
+// single-column scan speed
+//
+// Build: g++ -O2 -std=c++17 -pthread -o archive_bench bench/archive_bench.cpp
+
+#define GADGETSTORE_NO_MAIN
+#include "../GadgetStore.cpp"
+
+#include <chrono>
+
+namespace {
+
+using Catalog = std::map<std::string, std::vector<Gadget>>;
+using Clock = std::chrono::steady_clock;
+
+const std::vector<std::pair<std::string, size_t>> categorySizes = {
+    {"Phone", 6000}, {"Laptop", 2500}, {"Tablet", 1000}, {"Watch", 400}, {"Camera", 100}
+};
+const std::vector<std::string> brands = {
+    "Apple", "Samsung", "Google", "Sony", "Lenovo", "Asus", "Dell", "Xiaomi"
+};
+
+constexpr int DAYS = 365;
+constexpr int CHANGES_PER_THOUSAND = 100;   // Share of gadgets whose stock changes each day
+constexpr int NEW_GADGETS_PER_DAY = 5;
+
+double millisecondsSince(Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+// Calendar date (YYYYMMDD) a number of days after 1 January 2026
+int dateAfter(int days) {
+    std::tm date = {};
+    date.tm_year = 2026 - 1900;
+    date.tm_mday = 1 + days;
+    date.tm_hour = 12;
+    std::mktime(&date);
+    return (date.tm_year + 1900) * 10000 + (date.tm_mon + 1) * 100 + date.tm_mday;
+}
+
+// Serial numbers in the CCYYNNNNN format the store generates
+std::string serialFor(const std::string& category, int counter) {
+    std::stringstream ss;
+    ss << static_cast<char>(std::toupper(category[0])) << static_cast<char>(std::toupper(category[1]))
+       << "26" << std::setfill('0') << std::setw(5) << counter;
+    return ss.str();
+}
+
+void addGadget(Catalog& catalog, std::map<std::string, int>& counters,
+               const std::string& category, std::mt19937& rng) {
+    int counter = ++counters[category];
+    catalog[category].emplace_back(
+        "Model" + std::to_string(rng() % 300), category, serialFor(category, counter),
+        brands[rng() % brands.size()], (rng() % 200000) / 100.0,
+        InputValidator::validColors[rng() % InputValidator::validColors.size()],
+        static_cast<int>(rng() % 500));
+}
+
+}  // namespace
+
+int main() {
+    std::mt19937 rng(2026);
+    Catalog catalog;
+    std::map<std::string, int> counters;
+    for (const auto& entry : categorySizes) {
+        for (size_t i = 0; i < entry.second; ++i) addGadget(catalog, counters, entry.first, rng);
+    }
+
+    InventoryArchive archive;
+    double archiveMs = 0.0;
+    size_t rows = 0;
+    for (int day = 0; day < DAYS; ++day) {
+        for (auto& category : catalog) {
+            for (auto& gadget : category.second) {
+                if (static_cast<int>(rng() % 1000) < CHANGES_PER_THOUSAND) {
+                    gadget.setStockQuantity(static_cast<int>(rng() % 500));
+                }
+            }
+        }
+        for (int i = 0; i < NEW_GADGETS_PER_DAY; ++i) {
+            addGadget(catalog, counters, categorySizes[rng() % categorySizes.size()].first, rng);
+        }
+
+        auto start = Clock::now();
+        archive.addSnapshot(dateAfter(day), catalog);
+        archiveMs += millisecondsSince(start);
+        for (const auto& category : catalog) rows += category.second.size();
+    }
+
+    // Check the latest snapshot restores to the current catalog
+    Catalog restored = archive.restore(archive.snapshotCount() - 1);
+    bool restoredOk = restored.size() == catalog.size();
+    for (const auto& category : catalog) {
+        const auto& original = category.second;
+        const auto& copy = restored[category.first];
+        restoredOk = restoredOk && copy.size() == original.size();
+        for (size_t i = 0; restoredOk && i < original.size(); ++i) {
+            restoredOk = copy[i].getSerialNumber() == original[i].getSerialNumber() &&
+                         copy[i].getModel() == original[i].getModel() &&
+                         copy[i].getBrand() == original[i].getBrand() &&
+                         copy[i].getColor() == original[i].getColor() &&
+                         copy[i].getStockQuantity() == original[i].getStockQuantity() &&
+                         std::llround(copy[i].getPrice() * 100) == std::llround(original[i].getPrice() * 100);
+        }
+    }
+
+    auto start = Clock::now();
+    auto totals = archive.totalStockByDate();
+    double totalsMs = millisecondsSince(start);
+
+    const int lookups = 100;
+    size_t historyRows = 0;
+    start = Clock::now();
+    for (int i = 0; i < lookups; ++i) {
+        historyRows += archive.stockHistory("Laptop", serialFor("Laptop", 1 + i * 20)).size();
+    }
+    double historyMs = millisecondsSince(start) / lookups;
+
+    start = Clock::now();
+    Catalog lastDay = archive.restore(archive.snapshotCount() - 1);
+    double restoreMs = millisecondsSince(start);
+
+    // Round trip through the saved form, and reject every sampled truncation of it
+    start = Clock::now();
+    std::stringstream saved;
+    archive.save(saved);
+    double saveMs = millisecondsSince(start);
+    std::string bytes = saved.str();
+
+    InventoryArchive reloaded;
+    start = Clock::now();
+    bool loadedOk = reloaded.load(saved);
+    double loadMs = millisecondsSince(start);
+    loadedOk = loadedOk && bytes.size() == archive.compressedBytes() &&
+               reloaded.snapshotCount() == archive.snapshotCount() &&
+               reloaded.snapshotDate(DAYS - 1) == dateAfter(DAYS - 1) &&
+               reloaded.totalStockByDate() == totals &&
+               reloaded.stockHistory("Laptop", serialFor("Laptop", 1)).size() ==
+                   archive.stockHistory("Laptop", serialFor("Laptop", 1)).size();
+    for (size_t length = 0; loadedOk && length < bytes.size(); length += 1 + bytes.size() / 97) {
+        std::stringstream truncated(bytes.substr(0, length));
+        loadedOk = !reloaded.load(truncated) && reloaded.snapshotCount() == archive.snapshotCount();
+    }
+
+    std::cout << std::fixed << std::setprecision(2)
+              << DAYS << " daily snapshots, " << rows << " archived rows\n"
+              << "raw size:            " << archive.rawBytes() / 1e6 << " MB\n"
+              << "saved archive size:  " << bytes.size() / 1e6 << " MB\n"
+              << "compression ratio:   " << archive.compressionRatio() << "x\n"
+              << "archiving time:      " << archiveMs / DAYS << " ms per snapshot\n"
+              << "stock column scan:   " << totalsMs << " ms for all dates ("
+              << rows / (totalsMs / 1000) / 1e6 << " M rows/s, " << totals.size() << " totals)\n"
+              << "stock history:       " << historyMs << " ms per serial over the year ("
+              << historyRows / lookups << " entries each)\n"
+              << "full restore:        " << restoreMs << " ms for the latest snapshot\n"
+              << "save / load:         " << saveMs << " ms / " << loadMs << " ms\n"
+              << "restore check:       " << (restoredOk ? "ok" : "MISMATCH") << '\n'
+              << "save/load check:     " << (loadedOk ? "ok" : "MISMATCH") << '\n';
+    return restoredOk && loadedOk ? 0 : 1;
+}
@@ -0,0 +1,142 @@
+// Parallel scan benchmark
+// Runs filter and map/reduce over a skewed 5M-item catalog serially and with
+// ParallelScan at increasing thread counts, checking results match the serial path
+//
+// Build: g++ -O2 -std=c++17 -pthread -o parallel_scan_bench bench/parallel_scan_bench.cpp
+
+#define GADGETSTORE_NO_MAIN
+#include "../GadgetStore.cpp"
+
+#include <chrono>
+
+namespace {
+
+using Catalog = ParallelScan::Catalog;
+using Clock = std::chrono::steady_clock;
+using Valuation = std::pair<long long, double>;
+
+// Category sizes are deliberately skewed: one category holds 80% of the items
+const std::vector<std::pair<std::string, size_t>> categorySizes = {
+    {"Phone", 4000000}, {"Laptop", 600000}, {"Tablet", 300000}, {"Watch", 90000},
+    {"Camera", 9000}, {"Speaker", 900}, {"Monitor", 90}, {"Drone", 9}, {"Console", 1}
+};
+const std::vector<std::string> brands = {
+    "Apple", "Samsung", "Google", "Sony", "Lenovo", "Asus", "Dell", "Xiaomi"
+};
+
+constexpr int ROUNDS = 3;
+
+double millisecondsSince(Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+std::string toUpper(std::string text) {
+    std::transform(text.begin(), text.end(), text.begin(), ::toupper);
+    return text;
+}
+
+// The same model-name match the store's search fallback performs
+bool matchesModel(const Gadget& gadget) {
+    return toUpper(gadget.getModel()).find("MODEL 12") != std::string::npos;
+}
+
+Valuation value(const Gadget& gadget) {
+    return Valuation(gadget.getStockQuantity(), gadget.getPrice() * gadget.getStockQuantity());
+}
+
+Valuation add(const Valuation& a, const Valuation& b) {
+    return Valuation(a.first + b.first, a.second + b.second);
+}
+
+// Best of ROUNDS runs, in milliseconds
+template<typename Scan>
+double bestOf(Scan scan) {
+    double best = 0.0;
+    for (int round = 0; round < ROUNDS; ++round) {
+        auto start = Clock::now();
+        scan();
+        double elapsed = millisecondsSince(start);
+        if (round == 0 || elapsed < best) best = elapsed;
+    }
+    return best;
+}
+
+}  // namespace
+
+int main() {
+    std::mt19937 rng(30);
+    Catalog catalog;
+    size_t items = 0;
+    for (const auto& entry : categorySizes) {
+        auto& gadgets = catalog[entry.first];
+        gadgets.reserve(entry.second);
+        for (size_t i = 0; i < entry.second; ++i) {
+            gadgets.emplace_back("Model " + std::to_string(rng() % 5000), entry.first,
+                                 "XX26" + std::to_string(i), brands[rng() % brands.size()],
+                                 (rng() % 100000) / 100.0,
+                                 InputValidator::validColors[rng() % InputValidator::validColors.size()],
+                                 static_cast<int>(rng() % 1000));
+        }
+        items += entry.second;
+    }
+
+    // Serial reference results, walking the catalog category by category
+    std::vector<Gadget> serialMatches;
+    Valuation serialValuation(0, 0.0);
+    double serialFilterMs = bestOf([&] {
+        serialMatches.clear();
+        for (const auto& category : catalog) {
+            for (const auto& gadget : category.second) {
+                if (matchesModel(gadget)) serialMatches.push_back(gadget);
+            }
+        }
+    });
+    double serialReduceMs = bestOf([&] {
+        serialValuation = Valuation(0, 0.0);
+        for (const auto& category : catalog) {
+            for (const auto& gadget : category.second) serialValuation = add(serialValuation, value(gadget));
+        }
+    });
+
+    std::cout << items << " gadgets in " << catalog.size() << " categories, "
+              << ParallelScan::threadCount() << " scan thread(s) available, "
+              << ParallelScan::MORSEL_SIZE << "-item morsels\n"
+              << std::fixed << std::setprecision(1)
+              << std::left << std::setw(10) << "threads" << std::right
+              << std::setw(12) << "filter ms" << std::setw(10) << "speedup"
+              << std::setw(12) << "reduce ms" << std::setw(10) << "speedup" << '\n'
+              << std::left << std::setw(10) << "serial" << std::right
+              << std::setw(12) << serialFilterMs << std::setw(10) << 1.0
+              << std::setw(12) << serialReduceMs << std::setw(10) << 1.0 << '\n';
+
+    bool ok = true;
+    for (size_t threads = 1; threads <= std::max<size_t>(8, ParallelScan::threadCount()); threads *= 2) {
+        if (threads > ParallelScan::threadCount()) {
+            std::cout << std::left << std::setw(10) << threads << "skipped (only "
+                      << ParallelScan::threadCount() << " hardware thread(s))\n";
+            continue;
+        }
+        ParallelScan::setThreadLimit(threads);
+
+        std::vector<Gadget> matches;
+        Valuation valuation;
+        double filterMs = bestOf([&] { matches = ParallelScan::filter(catalog, matchesModel); });
+        double reduceMs = bestOf([&] {
+            valuation = ParallelScan::mapReduce(catalog, Valuation(0, 0.0), value, add);
+        });
+
+        // Same gadgets in the same order, and the same totals
+        ok = ok && matches.size() == serialMatches.size() && valuation.first == serialValuation.first &&
+             std::fabs(valuation.second - serialValuation.second) <= 1e-6 * serialValuation.second;
+        for (size_t i = 0; ok && i < matches.size(); ++i) {
+            ok = GadgetSchema::equal(matches[i], serialMatches[i]);
+        }
+
+        std::cout << std::left << std::setw(10) << threads << std::right
+                  << std::setw(12) << filterMs << std::setw(10) << serialFilterMs / filterMs
+                  << std::setw(12) << reduceMs << std::setw(10) << serialReduceMs / reduceMs << '\n';
+    }
+
+    std::cout << "results match serial path: " << (ok ? "yes" : "NO") << '\n';
+    return ok ? 0 : 1;
+}
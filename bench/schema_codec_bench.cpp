@@ -0,0 +1,208 @@
+// Gadget codec benchmark
+// Compares the GadgetSchema-generated binary codec with a hand-written codec
+// producing the same byte layout, and checks round trips and truncated input.
+// Also times the generated hash and ordering against hand-written versions
+//
+// Build: g++ -O2 -std=c++17 -pthread -o schema_codec_bench bench/schema_codec_bench.cpp
+
+#define GADGETSTORE_NO_MAIN
+#include "../GadgetStore.cpp"
+
+#include <chrono>
+#include <tuple>
+#include <unordered_set>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr size_t GADGET_COUNT = 200000;
+constexpr int ROUNDS = 20;
+
+// Hand-written equivalent of GadgetSchema::serialize, field by field
+void appendString(std::string& out, const std::string& value) {
+    uint32_t length = static_cast<uint32_t>(value.size());
+    out.append(reinterpret_cast<const char*>(&length), sizeof(length));
+    out.append(value);
+}
+
+void handSerialize(const Gadget& gadget, std::string& out) {
+    appendString(out, gadget.getSerialNumber());
+    appendString(out, gadget.getBrand());
+    appendString(out, gadget.getModel());
+    appendString(out, gadget.getCategory());
+    double price = gadget.getPrice();
+    out.append(reinterpret_cast<const char*>(&price), sizeof(price));
+    appendString(out, gadget.getColor());
+    int quantity = gadget.getStockQuantity();
+    out.append(reinterpret_cast<const char*>(&quantity), sizeof(quantity));
+}
+
+bool readString(const std::string& in, size_t& pos, std::string& value) {
+    uint32_t length;
+    if (pos > in.size() || in.size() - pos < sizeof(length)) return false;
+    std::memcpy(&length, in.data() + pos, sizeof(length));
+    pos += sizeof(length);
+    if (in.size() - pos < length) return false;
+    value.assign(in, pos, length);
+    pos += length;
+    return true;
+}
+
+template<typename T>
+bool readNumber(const std::string& in, size_t& pos, T& value) {
+    if (pos > in.size() || in.size() - pos < sizeof(T)) return false;
+    std::memcpy(&value, in.data() + pos, sizeof(T));
+    pos += sizeof(T);
+    return true;
+}
+
+// Hand-written equivalent of GadgetSchema::deserialize
+// Outside the class only the setters reach the members, so each string is copied
+// once more than in the generated decoder
+bool handDeserialize(const std::string& in, size_t& pos, Gadget& gadget) {
+    std::string serialNumber, brand, model, category, color;
+    double price;
+    int quantity;
+    if (!readString(in, pos, serialNumber) || !readString(in, pos, brand) ||
+        !readString(in, pos, model) || !readString(in, pos, category) ||
+        !readNumber(in, pos, price) || !readString(in, pos, color) ||
+        !readNumber(in, pos, quantity)) {
+        return false;
+    }
+    gadget.setSerialNumber(serialNumber);
+    gadget.setBrand(brand);
+    gadget.setModel(model);
+    gadget.setCategory(category);
+    gadget.setPrice(price);
+    gadget.setColor(color);
+    gadget.setStockQuantity(quantity);
+    return true;
+}
+
+// Hand-written equivalent of GadgetSchema::less, column by column
+bool handLess(const Gadget& a, const Gadget& b) {
+    return std::forward_as_tuple(a.getSerialNumber(), a.getBrand(), a.getModel(), a.getCategory(),
+                                 a.getPrice(), a.getColor(), a.getStockQuantity()) <
+           std::forward_as_tuple(b.getSerialNumber(), b.getBrand(), b.getModel(), b.getCategory(),
+                                 b.getPrice(), b.getColor(), b.getStockQuantity());
+}
+
+template<typename Encode>
+double timeEncode(const std::vector<Gadget>& gadgets, std::string& out, Encode encode) {
+    auto start = Clock::now();
+    for (int round = 0; round < ROUNDS; ++round) {
+        out.clear();
+        for (const auto& gadget : gadgets) encode(gadget, out);
+    }
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+template<typename Decode>
+double timeDecode(const std::string& in, std::vector<Gadget>& gadgets, Decode decode) {
+    auto start = Clock::now();
+    for (int round = 0; round < ROUNDS; ++round) {
+        size_t pos = 0;
+        for (auto& gadget : gadgets) decode(in, pos, gadget);
+    }
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+}  // namespace
+
+int main() {
+    std::mt19937 rng(29);
+    const std::vector<std::string> brands = {"Apple", "Samsung", "Google", "Sony", "Lenovo"};
+    const std::vector<std::string> categories = {"Phone", "Laptop", "Tablet", "Smart Watch"};
+
+    std::vector<Gadget> gadgets;
+    gadgets.reserve(GADGET_COUNT);
+    for (size_t i = 0; i < GADGET_COUNT; ++i) {
+        gadgets.emplace_back("Model " + std::to_string(rng() % 5000), categories[rng() % categories.size()],
+                             "PH26" + std::to_string(10000 + i), brands[rng() % brands.size()],
+                             (rng() % 100000) / 100.0,
+                             InputValidator::validColors[rng() % InputValidator::validColors.size()],
+                             static_cast<int>(rng() % 1000));
+    }
+
+    std::string generated, handWritten;
+    double generatedEncodeMs = timeEncode(gadgets, generated, GadgetSchema::serialize);
+    double handEncodeMs = timeEncode(gadgets, handWritten, handSerialize);
+
+    std::vector<Gadget> decoded(GADGET_COUNT), handDecoded(GADGET_COUNT);
+    double generatedDecodeMs = timeDecode(generated, decoded, GadgetSchema::deserialize);
+    double handDecodeMs = timeDecode(handWritten, handDecoded, handDeserialize);
+
+    bool ok = generated == handWritten;
+    for (size_t i = 0; ok && i < GADGET_COUNT; ++i) {
+        ok = GadgetSchema::equal(decoded[i], gadgets[i]) && GadgetSchema::equal(handDecoded[i], gadgets[i]);
+    }
+
+    // Every truncation of one encoded gadget must be rejected, as must a position past the end
+    std::string single;
+    GadgetSchema::serialize(gadgets.front(), single);
+    for (size_t length = 0; ok && length < single.size(); ++length) {
+        size_t pos = 0;
+        Gadget gadget;
+        ok = !GadgetSchema::deserialize(single.substr(0, length), pos, gadget);
+    }
+    size_t pastEnd = single.size() + 1;
+    Gadget ignored;
+    ok = ok && !GadgetSchema::deserialize(single, pastEnd, ignored);
+
+    // Equal gadgets must hash equally, and compare() must agree with equal() and less()
+    for (size_t i = 0; ok && i < GADGET_COUNT; ++i) {
+        const Gadget& a = gadgets[i];
+        const Gadget& b = gadgets[(i * 7919) % GADGET_COUNT];
+        int order = GadgetSchema::compare(a, b);
+        ok = GadgetSchema::hash(a) == GadgetSchema::hash(decoded[i]) &&
+             GadgetSchema::compare(a, decoded[i]) == 0 &&
+             (order == 0) == GadgetSchema::equal(a, b) &&
+             (order < 0) == GadgetSchema::less(a, b) &&
+             (order > 0) == GadgetSchema::less(b, a) &&
+             GadgetSchema::less(a, b) == handLess(a, b);
+    }
+
+    // Reuse 1000 serial numbers so sorting has to look past the leading column
+    std::vector<Gadget> generatedSorted = gadgets;
+    for (size_t i = 0; i < GADGET_COUNT; ++i) {
+        GadgetSchema::SerialNumber::set(generatedSorted[i], "PH26" + std::to_string(10000 + rng() % 1000));
+    }
+    std::vector<Gadget> handSorted = generatedSorted;
+
+    auto start = Clock::now();
+    std::sort(generatedSorted.begin(), generatedSorted.end(), GadgetSchema::less);
+    double generatedSortMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    start = Clock::now();
+    std::sort(handSorted.begin(), handSorted.end(), handLess);
+    double handSortMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    for (size_t i = 0; ok && i < GADGET_COUNT; ++i) {
+        ok = GadgetSchema::equal(generatedSorted[i], handSorted[i]);
+    }
+
+    start = Clock::now();
+    std::unordered_set<size_t> hashes;
+    for (const auto& gadget : gadgets) hashes.insert(GadgetSchema::hash(gadget));
+    double hashMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    // Serial numbers are unique, so collisions mean the fields are not being mixed
+    ok = ok && hashes.size() > GADGET_COUNT * 99 / 100;
+
+    double megabytes = generated.size() * ROUNDS / 1e6;
+    std::cout << std::fixed << std::setprecision(1)
+              << GADGET_COUNT << " gadgets x " << ROUNDS << " rounds, "
+              << generated.size() / 1e6 << " MB per round\n"
+              << "encode  generated: " << std::setw(7) << generatedEncodeMs << " ms ("
+              << megabytes / (generatedEncodeMs / 1000) << " MB/s)\n"
+              << "encode  hand:      " << std::setw(7) << handEncodeMs << " ms ("
+              << megabytes / (handEncodeMs / 1000) << " MB/s)\n"
+              << "decode  generated: " << std::setw(7) << generatedDecodeMs << " ms ("
+              << megabytes / (generatedDecodeMs / 1000) << " MB/s)\n"
+              << "decode  hand:      " << std::setw(7) << handDecodeMs << " ms ("
+              << megabytes / (handDecodeMs / 1000) << " MB/s)\n"
+              << "sort    generated: " << std::setw(7) << generatedSortMs << " ms\n"
+              << "sort    hand:      " << std::setw(7) << handSortMs << " ms\n"
+              << "hash:              " << std::setw(7) << hashMs << " ms ("
+              << hashes.size() << " distinct of " << GADGET_COUNT << ")\n"
+              << "checks:            " << (ok ? "ok" : "FAILED") << '\n';
+    return ok ? 0 : 1;
+}
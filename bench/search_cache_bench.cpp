@@ -0,0 +1,101 @@
+// Search cache benchmark
+// Runs a Zipfian search workload with occasional additions against the store,
+// once with the search cache disabled and once with the default cache
+//
+// Build: g++ -O2 -std=c++17 -pthread -o search_cache_bench bench/search_cache_bench.cpp
+
+#define GADGETSTORE_NO_MAIN
+#include "../GadgetStore.cpp"
+
+#include <chrono>
+
+namespace {
+
+const std::vector<std::string> categories = {
+    "Phone", "Laptop", "Tablet", "Watch", "Camera", "Speaker", "Headphones", "Monitor"
+};
+const std::vector<std::string> brands = {
+    "Apple", "Samsung", "Google", "Sony", "Lenovo", "Asus", "Dell", "Xiaomi", "Huawei", "Acer"
+};
+
+constexpr size_t CATALOG_SIZE = 50000;
+constexpr size_t MODEL_COUNT = 2000;
+constexpr size_t QUERY_COUNT = 2000;
+constexpr size_t QUERIES_PER_ADD = 100;
+
+std::string modelName(size_t index) {
+    return "Model" + std::to_string(index);
+}
+
+// Samples ranks 0..n-1 with probability proportional to 1 / (rank + 1)
+class ZipfSampler {
+public:
+    explicit ZipfSampler(size_t n) {
+        double sum = 0.0;
+        for (size_t rank = 0; rank < n; ++rank) {
+            sum += 1.0 / (rank + 1);
+            cdf.push_back(sum);
+        }
+        for (double& value : cdf) value /= sum;
+    }
+
+    size_t operator()(std::mt19937& rng) const {
+        double u = std::uniform_real_distribution<double>(0.0, 1.0)(rng);
+        return std::lower_bound(cdf.begin(), cdf.end(), u) - cdf.begin();
+    }
+
+private:
+    std::vector<double> cdf;
+};
+
+void addRandomGadget(GadgetStore& store, std::mt19937& rng) {
+    store.addGadget(modelName(rng() % MODEL_COUNT),
+                    categories[rng() % categories.size()],
+                    brands[rng() % brands.size()],
+                    (rng() % 100000) / 100.0,
+                    InputValidator::validColors[rng() % InputValidator::validColors.size()],
+                    static_cast<int>(rng() % 100));
+}
+
+void runWorkload(const std::string& label, size_t cacheCapacity, const std::vector<std::string>& terms) {
+    std::mt19937 rng(42);
+    GadgetStore store(cacheCapacity);
+    for (size_t i = 0; i < CATALOG_SIZE; ++i) addRandomGadget(store, rng);
+
+    ZipfSampler zipf(terms.size());
+    size_t matched = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < QUERY_COUNT; ++i) {
+        if (i % QUERIES_PER_ADD == QUERIES_PER_ADD - 1) addRandomGadget(store, rng);
+        matched += store.search(terms[zipf(rng)])->gadgets.size();
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    const SearchCache::Stats& stats = store.getSearchCacheStats();
+    std::cout << std::left << std::setw(22) << label
+              << std::right << std::setw(10) << std::fixed << std::setprecision(0) << QUERY_COUNT / seconds << " q/s"
+              << std::setw(9) << std::setprecision(1) << stats.hitRate() * 100 << "% hits"
+              << std::setw(8) << stats.evictions << " evictions"
+              << std::setw(8) << stats.invalidations << " invalidations"
+              << std::setw(8) << store.getSearchCacheRows() << " cached rows"
+              << "  (" << matched << " rows)\n";
+}
+
+}  // namespace
+
+int main() {
+    // Query vocabulary: brands, categories and model names, shuffled so that the
+    // popular Zipf ranks mix all three kinds of search
+    std::vector<std::string> terms;
+    for (const auto& brand : brands) terms.push_back(brand);
+    for (const auto& category : categories) terms.push_back(category);
+    for (size_t i = 0; i < 400; ++i) terms.push_back(modelName(i * 5));
+    std::shuffle(terms.begin(), terms.end(), std::mt19937(7));
+
+    std::cout << CATALOG_SIZE << " gadgets, " << QUERY_COUNT << " Zipfian searches over "
+              << terms.size() << " terms, one add per " << QUERIES_PER_ADD << " searches\n";
+    runWorkload("cache disabled", 0, terms);
+    runWorkload("default cache (64)", SearchCache::DEFAULT_CAPACITY, terms);
+    return 0;
+}